@@ -2,4 +2,4 @@
 import unreal as ue
 
 # import utility
-from utility.asset_action import run_image_2_text, run_clip_tagging, PythonAITagsEditorLibrary #, AITaggingAssetActionTool
\ No newline at end of file
+from utility.asset_action import run_image_2_text, run_clip_tagging, cancel_tagging, PythonAITagsEditorLibrary #, AITaggingAssetActionTool
\ No newline at end of file
@@ -0,0 +1,118 @@
+import sys
+import os
+import time
+
+import run_clip_category as clip_category
+from run_clip_category import torch
+
+# Benchmark for multi-view CLIP tagging: label recall against time per asset for each number of views.
+#
+# Usage: python bench_clip_views.py <labelled.json> [per_category] [threshold] [output.csv]
+# per_category and threshold are the same arguments run_clip_category.py gets from the editor.
+#
+# The labelled file is an input.json written by StartCLIPTagging with NumViews=4,
+# where every entry gets the expected tags added by hand:
+#   { "Entries": [ { "AssetPath": "...", "ImagePaths": ["...", ...], "Labels": ["house", "medieval"] } ] }
+# Image paths that no longer exist are looked up next to the labelled file, relative paths or just the file name.
+# Recall is the share of hand-written labels found in the predicted tags.
+# Only entries with every view (meshes) are measured, so each row compares the same assets.
+# Time per asset is CLIP encode + match on the saved PNGs plus, when the file has ViewRenderMs,
+# the editor cost of rendering, compressing and writing the first K views.
+
+def resolve_image_path(image_path, base_dir):
+    if os.path.isabs(image_path) and os.path.exists(image_path):
+        return image_path
+    relative_path = os.path.join(base_dir, image_path)
+    if os.path.exists(relative_path):
+        return relative_path
+    return os.path.join(base_dir, os.path.basename(image_path))
+
+def synchronize():
+    if clip_category.device == "cuda":
+        torch.cuda.synchronize()
+    elif clip_category.device == "mps":
+        torch.mps.synchronize()
+
+def get_render_ms(entries, num_views):
+    if not all(len(entry.get('ViewRenderMs', [])) >= num_views for entry in entries):
+        return None
+    return sum(sum(entry['ViewRenderMs'][:num_views]) for entry in entries) / len(entries)
+
+def run_views(entries, tag_embeddings, num_views):
+    hits = 0
+    total = 0
+    elapsed = 0.0
+    for entry in entries:
+        image_paths = entry['ResolvedImagePaths'][:num_views]
+        start = time.perf_counter()
+        image_embedding = clip_category.get_image_embedding(image_paths)
+        matched = clip_category.match_tags(image_embedding, tag_embeddings)
+        synchronize()
+        elapsed += time.perf_counter() - start
+
+        predicted = set(tag for selected in matched.values() for tag in selected)
+        labels = entry.get('Labels', [])
+        hits += sum(1 for label in labels if label in predicted)
+        total += len(labels)
+    recall = hits / total if total > 0 else 0.0
+    return recall, elapsed / len(entries)
+
+if __name__ == '__main__':
+    if len(sys.argv) <= 1:
+        raise Exception('Labelled input file is not provided')
+    input_filepath = sys.argv[1]
+
+    if len(sys.argv) >= 3:
+        clip_category.USE_PER_CATEGORY = sys.argv[2] == '1'
+
+    if len(sys.argv) >= 4:
+        clip_category.THRESHOLD = float(sys.argv[3])
+        clip_category.USE_THRESHOLD = clip_category.THRESHOLD > 0.0
+
+    output_filepath = sys.argv[4] if len(sys.argv) >= 5 else None
+
+    data = clip_category.load_input_file(input_filepath)
+    base_dir = os.path.dirname(os.path.abspath(input_filepath))
+    entries = [entry for entry in data.get('Entries', []) if entry.get('Labels') and clip_category.get_entry_image_paths(entry)]
+    if not entries:
+        print("Error: No labelled entries with images found.")
+        sys.exit(1)
+    for entry in entries:
+        entry['ResolvedImagePaths'] = [resolve_image_path(image_path, base_dir) for image_path in clip_category.get_entry_image_paths(entry)]
+
+    max_views = max(len(entry['ResolvedImagePaths']) for entry in entries)
+    skipped = sum(1 for entry in entries if len(entry['ResolvedImagePaths']) < max_views)
+    entries = [entry for entry in entries if len(entry['ResolvedImagePaths']) >= max_views]
+    if skipped > 0:
+        print(f"Skipping {skipped} entries with fewer than {max_views} views (non-mesh assets).")
+
+    tag_embeddings = clip_category.get_tag_embeddings(clip_category.USE_PER_CATEGORY)
+
+    # Warm up so the first measured pass doesn't pay for kernel setup
+    run_views(entries[:1], tag_embeddings, max_views)
+
+    rows = []
+    print(f"Device: {clip_category.device}, entries: {len(entries)}")
+    print(f"Using per category: {clip_category.USE_PER_CATEGORY}, threshold: {clip_category.THRESHOLD}, use threshold: {clip_category.USE_THRESHOLD}")
+    print("Recall: share of hand-written labels found in the predicted tags.")
+    if get_render_ms(entries, max_views) is None:
+        print("Warning: No ViewRenderMs in the labelled file, editor render cost is excluded from ms/asset.")
+    print(f"{'Views':>5} {'Recall':>9} {'encode ms':>10} {'render ms':>10} {'ms/asset':>9}")
+    for num_views in range(1, max_views + 1):
+        recall, seconds_per_asset = run_views(entries, tag_embeddings, num_views)
+        encode_ms = seconds_per_asset * 1000.0
+        render_ms = get_render_ms(entries, num_views)
+        total_ms = encode_ms + (render_ms or 0.0)
+        rows.append((num_views, recall, encode_ms, render_ms, total_ms))
+        render_text = f"{render_ms:>10.1f}" if render_ms is not None else f"{'n/a':>10}"
+        print(f"{num_views:>5} {recall:>9.3f} {encode_ms:>10.1f} {render_text} {total_ms:>9.1f}")
+        sys.stdout.flush()
+
+    if output_filepath:
+        print(f"Saving benchmark file: {output_filepath}")
+        os.makedirs(os.path.dirname(os.path.abspath(output_filepath)), exist_ok=True)
+        with open(output_filepath, "w", encoding="utf-8") as outfile:
+            outfile.write("views,label_recall,encode_ms_per_asset,render_ms_per_asset,ms_per_asset\n")
+            for num_views, recall, encode_ms, render_ms, total_ms in rows:
+                render_text = f"{render_ms:.2f}" if render_ms is not None else ""
+                outfile.write(f"{num_views},{recall:.4f},{encode_ms:.2f},{render_text},{total_ms:.2f}\n")
@@ -0,0 +1,56 @@
+import sys
+import os
+import json
+import time
+
+# Lines starting with this prefix are parsed by UAITagsEditorSubsystem, everything else is just logged
+PROGRESS_PREFIX = "@AITagsProgress "
+# Exit code telling the subsystem the job stopped because the user pressed Cancel,
+# chosen so it can't be confused with the interpreter's own exit codes (e.g. 2 for startup errors)
+CANCELLED_EXIT_CODE = 86
+# The subsystem creates this file next to input.json to request a cancel
+CANCEL_FILE_NAME = "cancel"
+
+class JobProgress:
+    """
+    Structured progress channel from the worker to the editor.
+    Reports items done, items/sec, current stage and errors, and checks for a cancel request between items.
+    """
+
+    def __init__(self, input_path, device="cpu"):
+        self.cancel_path = os.path.join(os.path.dirname(input_path), CANCEL_FILE_NAME)
+        self.device = device
+        self.stage_name = "starting"
+        self.done = 0
+        self.total = 0
+        self.errors = 0
+        self.cancelled = False
+        self.start_time = time.perf_counter()
+
+    def stage(self, name, total=None):
+        self.stage_name = name
+        if total is not None:
+            self.done = 0
+            self.total = total
+            self.start_time = time.perf_counter()
+        self.report()
+
+    def step(self, error=False):
+        self.done += 1
+        if error:
+            self.errors += 1
+        self.report()
+
+    def is_cancelled(self):
+        # Latched, so a job that stopped early still reports cancelled after saving its partial output
+        if not self.cancelled:
+            self.cancelled = os.path.exists(self.cancel_path)
+        return self.cancelled
+
+    def report(self):
+        elapsed = time.perf_counter() - self.start_time
+        items_per_sec = self.done / elapsed if elapsed > 0.0 else 0.0
+        payload = dict(stage=self.stage_name, done=self.done, total=self.total,
+                       items_per_sec=round(items_per_sec, 3), errors=self.errors, device=self.device)
+        print(PROGRESS_PREFIX + json.dumps(payload))
+        sys.stdout.flush()
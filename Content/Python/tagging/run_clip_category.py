@@ -3,6 +3,7 @@ import os
 import json
 import warnings
 from PIL import Image
+from job_progress import JobProgress, CANCELLED_EXIT_CODE
 
 # Suppress specific warning message
 warnings.filterwarnings("ignore", message=".*Torch was not compiled with flash attention.*")
@@ -58,12 +59,22 @@ def get_tag_embeddings(per_category=True):
         return tag_embeddings
 
 # --- PROCESS IMAGES ---
-def get_image_embedding(image_path):
-    image = preprocess(Image.open(image_path).convert("RGB")).unsqueeze(0).to(device)
+def get_image_embedding(image_paths):
+    # All views of one asset go through the encoder as a single batch, then get averaged
+    images = torch.stack([preprocess(Image.open(image_path).convert("RGB")) for image_path in image_paths]).to(device)
     with torch.no_grad():
-        image_embedding = model.encode_image(image).float()
-        image_embedding /= image_embedding.norm(dim=-1, keepdim=True)
-    return image_embedding[0]
+        image_embeddings = model.encode_image(images).float()
+        image_embeddings /= image_embeddings.norm(dim=-1, keepdim=True)
+        image_embedding = image_embeddings.mean(dim=0)
+        image_embedding /= image_embedding.norm()
+    return image_embedding
+
+def get_entry_image_paths(entry):
+    image_paths = entry.get('ImagePaths', None)
+    if image_paths:
+        return image_paths
+    image_path = entry.get('ImagePath', None)
+    return [image_path] if image_path else []
 
 log_enabled = True
 USE_PER_CATEGORY = True
@@ -74,7 +85,42 @@ USE_SOFTMAX = True
 USE_MAX_TAGS = True
 MAX_TAGS = 3
 
-def process_data(data):
+def match_tags(image_embedding, tag_embeddings):
+    matched = {}
+    for category, tag_vectors in tag_embeddings.items():
+        selected = []
+        tags = tag_vectors["tags"]
+        tag_embeds = tag_vectors["embeddings"]
+        if USE_THRESHOLD:
+            values = []
+            for index in range(len(tag_embeds)):
+                tag = tags[index]
+                similarity = torch.dot(image_embedding, tag_embeds[index]).item()
+                # print(f"{category} {tag}: tag_embeds: \n{similarity}\n")
+                if similarity >= THRESHOLD:
+                    values.append((tag, round(similarity, 3) * 100))
+            values.sort(key=lambda x: -x[1])
+            # print(f"{category}: values = {values}\n")
+            result_tags = [item[0] for item in values]
+            if USE_MAX_TAGS:
+                selected.extend(result_tags[:MAX_TAGS])
+            else:
+                selected.extend(result_tags)
+        else:
+            # print(f"{category} {tags}: tag_embeds: \n{tag_embeds}\n")
+            similarity = (image_embedding @ tag_embeds.T).squeeze(0)
+            # tag_score_pairs = [(tag, round(float(score), 3)) for tag, score in zip(tags, similarity)]
+            # print(f"Similarity for {category}: \n"
+            #       f"\t\t{tag_score_pairs}")
+            if USE_SOFTMAX:
+                top_indices = [torch.argmax(torch.softmax(similarity, dim=0))]
+            else:
+                top_indices = similarity.topk(TOPK).indices
+            selected = [tags[i] for i in top_indices]
+        matched[category] = selected
+    return matched
+
+def process_data(data, progress):
     if not data:
         print(f"Error: No data provided.")
         sys.stdout.flush()
@@ -84,61 +130,44 @@ def process_data(data):
         print(f"Processing json: {data}")
         sys.stdout.flush()
 
+    progress.stage("encoding tags")
     tag_embeddings = get_tag_embeddings(USE_PER_CATEGORY)
 
     # get entries array from data
     entries = data.get('Entries', [])
+    out_entries = []
+    progress.stage("tagging", total=len(entries))
 
     for entry in entries:
+        # Cancel only between items, entries finished so far are still saved
+        if progress.is_cancelled():
+            print("Cancelled.")
+            sys.stdout.flush()
+            break
         if log_enabled:
             print(f"Processing entry: {entry}")
             sys.stdout.flush()
-        image_path = entry.get('ImagePath', None)
-        if image_path:
+        image_paths = get_entry_image_paths(entry)
+        if image_paths:
             if log_enabled:
-                print(f"Processing image: {image_path}")
+                print(f"Processing images: {image_paths}")
                 sys.stdout.flush()
 
-            image_embedding = get_image_embedding(image_path)
-
-            matched = {}
-            combined_tags = []
-            for category, tag_vectors in tag_embeddings.items():
-                selected = []
-                tags = tag_vectors["tags"]
-                tag_embeds = tag_vectors["embeddings"]
-                if USE_THRESHOLD:
-                    values = []
-                    for index in range(len(tag_embeds)):
-                        tag = tags[index]
-                        similarity = torch.dot(image_embedding, tag_embeds[index]).item()
-                        # print(f"{category} {tag}: tag_embeds: \n{similarity}\n")
-                        if similarity >= THRESHOLD:
-                            values.append((tag, round(similarity, 3) * 100))
-                    values.sort(key=lambda x: -x[1])
-                    # print(f"{category}: values = {values}\n")
-                    result_tags = [item[0] for item in values]
-                    if USE_MAX_TAGS:
-                        selected.extend(result_tags[:MAX_TAGS])
-                    else:
-                        selected.extend(result_tags)
-                else:
-                    # print(f"{category} {tags}: tag_embeds: \n{tag_embeds}\n")
-                    similarity = (image_embedding @ tag_embeds.T).squeeze(0)
-                    # tag_score_pairs = [(tag, round(float(score), 3)) for tag, score in zip(tags, similarity)]
-                    # print(f"Similarity for {category}: \n"
-                    #       f"\t\t{tag_score_pairs}")
-                    if USE_SOFTMAX:
-                        top_indices = [torch.argmax(torch.softmax(similarity, dim=0))]
-                    else:
-                        top_indices = similarity.topk(TOPK).indices
-                    selected = [tags[i] for i in top_indices]
-                matched[category] = selected
-                combined_tags.extend(selected)
+            try:
+                image_embedding = get_image_embedding(image_paths)
+                matched = match_tags(image_embedding, tag_embeddings)
+            except Exception as e:
+                print(f"Error: Failed to tag {image_paths}: {e}")
+                progress.step(error=True)
+                continue
             
             print(matched)
-            entry["CLIPTags"] = combined_tags
+            entry["CLIPTags"] = [tag for selected in matched.values() for tag in selected]
+            # Failed entries are left out so the editor keeps their existing tags
+            out_entries.append(entry)
+        progress.step()
 
+    data['Entries'] = out_entries
     return data
 
 if __name__ == '__main__':
@@ -158,6 +187,11 @@ if __name__ == '__main__':
         print(f"Using per category: {USE_PER_CATEGORY}, threshold: {THRESHOLD}, use threshold: {USE_THRESHOLD}")
         sys.stdout.flush()
 
+    progress = JobProgress(input_filepath, device)
+    progress.stage("loading input")
     json_data = load_input_file(input_filepath)
-    parsed_data = process_data(json_data)
+    parsed_data = process_data(json_data, progress)
+    progress.stage("saving")
     save_output_file(parsed_data, input_filepath)
+    if progress.cancelled:
+        sys.exit(CANCELLED_EXIT_CODE)
@@ -3,6 +3,7 @@ import os
 import json
 import warnings
 from PIL import Image
+from job_progress import JobProgress, CANCELLED_EXIT_CODE
 
 # Suppress specific warning message
 warnings.filterwarnings("ignore", message=".*Torch was not compiled with flash attention.*")
@@ -49,7 +50,7 @@ def get_ai_tags(image_path):
     # return ci.interrogate(image)
     return ci.interrogate_fast(image)
 
-def process_data(data):
+def process_data(data, progress):
     if not data:
         print(f"Error: No data provided.")
         sys.stdout.flush()
@@ -62,8 +63,14 @@ def process_data(data):
     if log_enabled:
         print(f"Processing json (entries: {len(entries)}): {data}")
         sys.stdout.flush()
+    progress.stage("captioning", total=len(entries))
         
     for entry in entries:
+        # Cancel only between items, entries finished so far are still saved
+        if progress.is_cancelled():
+            print("Cancelled.")
+            sys.stdout.flush()
+            break
         if log_enabled:
             print(f"Processing entry: {entry}")
             sys.stdout.flush()
@@ -73,13 +80,19 @@ def process_data(data):
                 print(f"Processing image: {image_path}")
                 sys.stdout.flush()
             # get ai tags for image
-            output = get_ai_tags(image_path)
+            try:
+                output = get_ai_tags(image_path)
+            except Exception as e:
+                print(f"Error: Failed to caption {image_path}: {e}")
+                progress.step(error=True)
+                continue
             if log_enabled:
                 print(f"Result: {output}")
                 sys.stdout.flush()
             # add ai tags to entry
             entry['Image2Text'] = output
             out_entries.append(entry)
+        progress.step()
     return dict(Entries = out_entries)
 
 if __name__ == '__main__':
@@ -90,7 +103,12 @@ if __name__ == '__main__':
 
     torch_cuda_available()
         
+    progress = JobProgress(input_filepath, config.device)
+    progress.stage("loading input")
     json_data = load_input_file(input_filepath)
-    parsed_data = process_data(json_data)
+    parsed_data = process_data(json_data, progress)
+    progress.stage("saving")
     save_output_file(parsed_data, input_filepath)
+    if progress.cancelled:
+        sys.exit(CANCELLED_EXIT_CODE)
     
\ No newline at end of file
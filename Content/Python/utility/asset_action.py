@@ -12,9 +12,10 @@ def run_image_2_text():
     unreal.log("Python:: Running image to text tagging...")
     subsystem.start_image_to_text()
 
-def run_clip_tagging(use_per_category=False, use_threshold=False, threshold=0.2):
+def run_clip_tagging(use_per_category=False, use_threshold=False, threshold=0.2, num_views=1):
     """
     Function to run clip tagging.
+    num_views > 1 renders extra mesh views (back, top, side) and averages their embeddings.
     """
     subsystem = unreal.get_editor_subsystem(unreal.AITagsEditorSubsystem)
     subsystem.clean_cached_assets()
@@ -23,7 +24,14 @@ def run_clip_tagging(use_per_category=False, use_threshold=False, threshold=0.2)
     subsystem.add_assets_to_cache(selected_assets)
 
     unreal.log("Python:: Running clip tagging...")
-    subsystem.start_clip_tagging(use_per_category, use_threshold, threshold)
+    subsystem.start_clip_tagging(use_per_category, use_threshold, threshold, num_views)
+
+def cancel_tagging():
+    """
+    Function to stop the running tagging job after its current item.
+    """
+    subsystem = unreal.get_editor_subsystem(unreal.AITagsEditorSubsystem)
+    subsystem.cancel_tagging()
     
 @unreal.uclass()
 class PythonAITagsEditorLibrary(unreal.BlueprintFunctionLibrary):
@@ -36,9 +44,9 @@ class PythonAITagsEditorLibrary(unreal.BlueprintFunctionLibrary):
     def RunImage2TextFunc():
         run_image_2_text()
 
-    @unreal.ufunction(static=True, meta=dict(Category="AITagging"), params=[bool, bool, float])
-    def RunCLIPTaggingFunc(use_per_category:bool=True, use_threshold:bool=False, threshold:float=0.2):
-        run_clip_tagging(use_per_category, use_threshold, threshold)
+    @unreal.ufunction(static=True, meta=dict(Category="AITagging"), params=[bool, bool, float, int])
+    def RunCLIPTaggingFunc(use_per_category:bool=True, use_threshold:bool=False, threshold:float=0.2, num_views:int=1):
+        run_clip_tagging(use_per_category, use_threshold, threshold, num_views)
 
 # NOTICE:
 # This class is not working with Blutility because Epic searches for FAssetData instead runtime UObject
@@ -12,6 +12,8 @@ public class AITagging : ModuleRules
 			new string[]
 			{
 				"Core",
+				"Slate",
+				"SlateCore",
 			}
 			);
 		
@@ -20,16 +22,13 @@ public class AITagging : ModuleRules
 			{
 				"CoreUObject",
 				"Engine",
-				"Slate",
-				"SlateCore",
 				"UnrealEd",
 				"EditorSubsystem",
 				"EditorScriptingUtilities",
 				"Json",
 				"RHI",
 				"RHICore",
-				"Slate",
-				"SlateCore",
+				"Projects",
 			}
 			);
 	}
@@ -7,6 +7,7 @@
 #include "Editor.h"
 #include "EditorAssetLibrary.h"
 #include "ThumbnailRendering/ThumbnailManager.h"
+#include "ThumbnailRendering/SceneThumbnailInfo.h"
 #include "IImageWrapperModule.h"
 #include "IImageWrapper.h"
 #include "Misc/FileHelper.h"
@@ -25,6 +26,10 @@
 #include "Editor/UnrealEdEngine.h"
 #include "Framework/Notifications/NotificationManager.h"
 #include "Widgets/Notifications/SNotificationList.h"
+#include "HAL/PlatformTime.h"
+#include "Misc/DateTime.h"
+#include "Misc/EngineVersion.h"
+#include "Interfaces/IPluginManager.h"
 
 DEFINE_LOG_CATEGORY_STATIC(LogAITagsEditor, Log, All);
 
@@ -47,6 +52,110 @@ namespace AITagsEditorUtils
 	{
 		return FPaths::ProjectIntermediateDir() / TEXT("AITagging");
 	}
+
+	// Must match tagging/job_progress.py
+	const TCHAR* ProgressPrefix = TEXT("@AITagsProgress ");
+	constexpr int32 CancelledReturnCode = 86;
+	// Logged for jobs that never reported back, e.g. replaced by StopCurrentProcess
+	constexpr int32 StoppedReturnCode = -1;
+
+	FString GetCancelFilePath()
+	{
+		return GetTemporaryFolder() / TEXT("cancel");
+	}
+
+	FString GetRunLogPath()
+	{
+		// Saved instead of Intermediate/AITagging, the temporary folder is wiped on every run
+		return FPaths::ProjectSavedDir() / TEXT("AITagging") / TEXT("RunLog.csv");
+	}
+
+	FString GetPluginVersion()
+	{
+		const TSharedPtr<IPlugin> Plugin = IPluginManager::Get().FindPlugin(TEXT("AITagging"));
+		return Plugin.IsValid() ? Plugin->GetDescriptor().VersionName : FString();
+	}
+
+	FString EscapeCsv(const FString& InValue)
+	{
+		return TEXT("\"") + InValue.Replace(TEXT("\""), TEXT("\"\"")) + TEXT("\"");
+	}
+
+	struct FThumbnailView
+	{
+		float OrbitPitch;
+		float OrbitYaw;
+	};
+
+	// Extra views orbiting around the mesh. View 0 is always the asset's own thumbnail camera (three-quarter by default),
+	// so view N uses ThumbnailViews[N - 1].
+	constexpr FThumbnailView ThumbnailViews[] = {
+		{0.f, 0.f},         // back
+		{-80.f, -180.f},    // top
+		{0.f, -90.f},       // side
+	};
+
+	int32 GetMaxThumbnailViews()
+	{
+		return 1 + UE_ARRAY_COUNT(ThumbnailViews);
+	}
+
+	bool SupportsThumbnailViews(const UObject* InObject)
+	{
+		return InObject && (InObject->IsA<UStaticMesh>() || InObject->IsA<USkeletalMesh>());
+	}
+
+	/** Swaps the mesh thumbnail camera for one of ThumbnailViews while in scope, the asset itself is left untouched. */
+	class FScopedThumbnailView
+	{
+	public:
+		FScopedThumbnailView(UObject* InObject, int32 ViewIndex)
+		{
+			if (ViewIndex <= 0 || !SupportsThumbnailViews(InObject))
+			{
+				return;
+			}
+
+			StaticMesh = Cast<UStaticMesh>(InObject);
+			SkeletalMesh = Cast<USkeletalMesh>(InObject);
+			OriginalInfo = StaticMesh ? StaticMesh->ThumbnailInfo.Get() : SkeletalMesh->GetThumbnailInfo();
+
+			USceneThumbnailInfo* ViewInfo = NewObject<USceneThumbnailInfo>(GetTransientPackage());
+			if (const USceneThumbnailInfo* OriginalSceneInfo = Cast<USceneThumbnailInfo>(OriginalInfo))
+			{
+				ViewInfo->OrbitZoom = OriginalSceneInfo->OrbitZoom;
+			}
+			const FThumbnailView& View = ThumbnailViews[ViewIndex - 1];
+			ViewInfo->OrbitPitch = View.OrbitPitch;
+			ViewInfo->OrbitYaw = View.OrbitYaw;
+			SetThumbnailInfo(ViewInfo);
+		}
+
+		~FScopedThumbnailView()
+		{
+			if (StaticMesh || SkeletalMesh)
+			{
+				SetThumbnailInfo(OriginalInfo);
+			}
+		}
+
+	private:
+		void SetThumbnailInfo(UThumbnailInfo* InInfo)
+		{
+			if (StaticMesh)
+			{
+				StaticMesh->ThumbnailInfo = InInfo;
+			}
+			else if (SkeletalMesh)
+			{
+				SkeletalMesh->SetThumbnailInfo(InInfo);
+			}
+		}
+
+		UStaticMesh* StaticMesh = nullptr;
+		USkeletalMesh* SkeletalMesh = nullptr;
+		UThumbnailInfo* OriginalInfo = nullptr;
+	};
 }
 
 #define LOCTEXT_NAMESPACE "AITagsEditorSubsystem"
@@ -66,7 +175,7 @@ void UAITagsEditorSubsystem::AddAssetsToCache(const TArray<FAssetData>& InAssetD
 	AssetsForAITagging.Append(InAssetDatas);
 }
 
-void UAITagsEditorSubsystem::StartCLIPTagging(bool bUsePerCategory, bool bUseThreshold, float Threshold)
+void UAITagsEditorSubsystem::StartCLIPTagging(bool bUsePerCategory, bool bUseThreshold, float Threshold, int32 NumViews)
 {
 	if (AssetsForAITagging.IsEmpty())
 	{
@@ -74,11 +183,24 @@ void UAITagsEditorSubsystem::StartCLIPTagging(bool bUsePerCategory, bool bUseThr
 		return;
 	}
 
-	UE_LOG(LogAITagsEditor, Log, TEXT("%hs: Start bUsePerCategory=%d bUseThreshold=%d Threshold=%.2f"), __FUNCTION__, bUsePerCategory, bUseThreshold, Threshold);
+	if (IsJobRunning())
+	{
+		UE_LOG(LogAITagsEditor, Error, TEXT("%hs: A tagging job is already running! Wait for it or cancel it first."), __FUNCTION__);
+		return;
+	}
+
+	NumViews = FMath::Clamp(NumViews, 1, AITagsEditorUtils::GetMaxThumbnailViews());
+
+	UE_LOG(LogAITagsEditor, Log, TEXT("%hs: Start bUsePerCategory=%d bUseThreshold=%d Threshold=%.2f NumViews=%d"), __FUNCTION__, bUsePerCategory, bUseThreshold, Threshold, NumViews);
 	
 	CleanUpTemporaryFolder();
-	const FString InputFullPath = PrepareThumbnailsAndInputFile();
-	LaunchCLIP(FPaths::ConvertRelativePathToFull(InputFullPath), bUsePerCategory, bUseThreshold, Threshold);
+	const FString InputFullPath = PrepareThumbnailsAndInputFile(NumViews);
+	if (InputFullPath.IsEmpty())
+	{
+		UE_LOG(LogAITagsEditor, Warning, TEXT("%hs: Thumbnails were not prepared, tagging is not launched."), __FUNCTION__);
+		return;
+	}
+	LaunchCLIP(FPaths::ConvertRelativePathToFull(InputFullPath), bUsePerCategory, bUseThreshold, Threshold, NumViews);
 }
 
 void UAITagsEditorSubsystem::StartImageToText()
@@ -89,35 +211,61 @@ void UAITagsEditorSubsystem::StartImageToText()
 		return;
 	}
 
+	if (IsJobRunning())
+	{
+		UE_LOG(LogAITagsEditor, Error, TEXT("%hs: A tagging job is already running! Wait for it or cancel it first."), __FUNCTION__);
+		return;
+	}
+
 	UE_LOG(LogAITagsEditor, Log, TEXT("%hs: Start"), __FUNCTION__);
 
 	CleanUpTemporaryFolder();
 	const FString InputFullPath = PrepareThumbnailsAndInputFile();
+	if (InputFullPath.IsEmpty())
+	{
+		UE_LOG(LogAITagsEditor, Warning, TEXT("%hs: Thumbnails were not prepared, image2text is not launched."), __FUNCTION__);
+		return;
+	}
 	LaunchImageToText(FPaths::ConvertRelativePathToFull(InputFullPath));
 }
 
-FString UAITagsEditorSubsystem::PrepareThumbnailsAndInputFile()
+FString UAITagsEditorSubsystem::PrepareThumbnailsAndInputFile(int32 NumViews)
 {
 	const FString TempDir = AITagsEditorUtils::GetTemporaryFolder();
 
-	TMap<FAssetData, FString> AssetImagePaths;
+	// Rendering happens on the game thread, every view of every asset is one unit of work
+	FScopedSlowTask SlowTask(AssetsForAITagging.Num() * NumViews, LOCTEXT("RenderingThumbnails", "Rendering thumbnails..."));
+	SlowTask.MakeDialog(/*bShowCancelButton=*/ true);
+
+	TMap<FAssetData, FAITagsAssetThumbnails> AssetThumbnails;
 	for (const FAssetData& AssetData : AssetsForAITagging)
 	{
-		const FString PngPath = SaveAssetThumbnailToDisk(AssetData, TempDir);
-		if (PngPath.IsEmpty())
+		if (SlowTask.ShouldCancel())
+		{
+			UE_LOG(LogAITagsEditor, Display, TEXT("AITagsEditorSubsystem: Thumbnail rendering cancelled by user."));
+			return FString();
+		}
+		SlowTask.EnterProgressFrame(NumViews, FText::Format(LOCTEXT("RenderingThumbnail", "Rendering {0}"), FText::FromName(AssetData.AssetName)));
+
+		FAITagsAssetThumbnails Thumbnails = SaveAssetThumbnailsToDisk(AssetData, TempDir, NumViews);
+		if (Thumbnails.ImagePaths.IsEmpty())
 		{
 			UE_LOG(LogAITagsEditor, Error, TEXT("AITagsEditorSubsystem: Failed to export thumbnail for %s"), *AssetData.AssetName.ToString());
 			continue; // Skip this asset
 		}
-		AssetImagePaths.Add(AssetData, FPaths::ConvertRelativePathToFull(PngPath));
+		for (FString& PngPath : Thumbnails.ImagePaths)
+		{
+			PngPath = FPaths::ConvertRelativePathToFull(PngPath);
+		}
+		AssetThumbnails.Add(AssetData, MoveTemp(Thumbnails));
 	}
 
 	FString InputFullPath;
-	WriteAssetImageArrayToJson(AssetImagePaths, TempDir, InputFullPath);
+	WriteAssetImageArrayToJson(AssetThumbnails, TempDir, InputFullPath);
 	return InputFullPath;
 }
 
-FString UAITagsEditorSubsystem::GetHashedFilename(const FAssetData& InAssetData) const
+FString UAITagsEditorSubsystem::GetHashedFilename(const FAssetData& InAssetData, int32 ViewIndex) const
 {
 	// -------------------------------
 	// 1. Compute a hash-based filename from the AssetData path
@@ -125,29 +273,33 @@ FString UAITagsEditorSubsystem::GetHashedFilename(const FAssetData& InAssetData)
 	// Use the full object path (e.g., "/Game/Props/SM_Rock.SM_Rock") to generate a CRC32 hash
 	const FString AssetPathString = InAssetData.GetObjectPathString();
 	const uint32 PathHash = FCrc::StrCrc32(*AssetPathString);
-	// Convert to an 8-digit hexadecimal string (lowercase) and append ".png"
-	const FString FileName = FString::Printf(TEXT("%08x.png"), PathHash);
+	// Convert to an 8-digit hexadecimal string (lowercase) and append ".png", extra views get a "_<index>" suffix
+	const FString FileName = ViewIndex > 0
+		                         ? FString::Printf(TEXT("%08x_%d.png"), PathHash, ViewIndex)
+		                         : FString::Printf(TEXT("%08x.png"), PathHash);
 	return FileName;
 }
 
-FString UAITagsEditorSubsystem::SaveAssetThumbnailToDisk(const FAssetData& AssetData, const FString& FolderPath,
-                                                         int32 ThumbnailSize)
+FAITagsAssetThumbnails UAITagsEditorSubsystem::SaveAssetThumbnailsToDisk(const FAssetData& AssetData, const FString& FolderPath,
+                                                                          int32 NumViews, int32 ThumbnailSize)
 {
+	FAITagsAssetThumbnails OutThumbnails;
 	if (!AssetData.IsValid())
 	{
-		return FString();
+		return OutThumbnails;
 	}
 
-	const FString FullFilePath = FolderPath / GetHashedFilename(AssetData);
-
-	// Generate a thumbnail!
-	FObjectThumbnail GeneratedThumbnail; // = ThumbnailTools::GenerateThumbnailForObjectToSaveToDisk( AssetData.GetAsset() );
-
 	// Does the object support thumbnails?
 	UObject* InObject = AssetData.GetAsset();
 	if (!InObject)
 	{
-		return FString();
+		return OutThumbnails;
+	}
+
+	// Only meshes have an orbit camera, everything else gets the single default thumbnail
+	if (!AITagsEditorUtils::SupportsThumbnailViews(InObject))
+	{
+		NumViews = 1;
 	}
 	
 	FThumbnailRenderingInfo* RenderInfo = GUnrealEd
@@ -221,19 +373,38 @@ FString UAITagsEditorSubsystem::SaveAssetThumbnailToDisk(const FAssetData& Asset
 			}
 		}
 
-		// Generate the thumbnail
-		// FObjectThumbnail NewThumbnail;
-		ThumbnailTools::RenderThumbnail(InObject, ThumbnailSize, ThumbnailSize, ThumbnailTools::EThumbnailTextureFlushMode::AlwaysFlush, NULL,
-		                                &GeneratedThumbnail);
+		// Generate the thumbnails, compilation above is shared by all views
+		for (int32 ViewIndex = 0; ViewIndex < NumViews; ++ViewIndex)
+		{
+			const double ViewStartTime = FPlatformTime::Seconds();
+			FObjectThumbnail GeneratedThumbnail;
+			{
+				AITagsEditorUtils::FScopedThumbnailView ScopedView(InObject, ViewIndex);
+				ThumbnailTools::RenderThumbnail(InObject, ThumbnailSize, ThumbnailSize, ThumbnailTools::EThumbnailTextureFlushMode::AlwaysFlush, NULL,
+				                                &GeneratedThumbnail);
+			}
+
+			const FString FullFilePath = FolderPath / GetHashedFilename(AssetData, ViewIndex);
+			if (SaveThumbnailToPng(GeneratedThumbnail, AssetData, FullFilePath))
+			{
+				OutThumbnails.ImagePaths.Add(FullFilePath);
+				OutThumbnails.ViewRenderMs.Add((FPlatformTime::Seconds() - ViewStartTime) * 1000.0);
+			}
+		}
 	}
 
-	const int32 Width = GeneratedThumbnail.GetImageWidth();
-	const int32 Height = GeneratedThumbnail.GetImageHeight();
-	const TArray<uint8>& ImageData = GeneratedThumbnail.GetUncompressedImageData();
+	return OutThumbnails;
+}
+
+bool UAITagsEditorSubsystem::SaveThumbnailToPng(const FObjectThumbnail& InThumbnail, const FAssetData& AssetData, const FString& FullFilePath)
+{
+	const int32 Width = InThumbnail.GetImageWidth();
+	const int32 Height = InThumbnail.GetImageHeight();
+	const TArray<uint8>& ImageData = InThumbnail.GetUncompressedImageData();
 	if (ImageData.IsEmpty())
 	{
 		UE_LOG(LogAITagsEditor, Error, TEXT("AITagsEditorSubsystem: No image data for thumbnail of %s"), *AssetData.AssetName.ToString());
-		return FString();
+		return false;
 	}
 
 	// 3) Compress to PNG via IImageWrapper
@@ -242,7 +413,7 @@ FString UAITagsEditorSubsystem::SaveAssetThumbnailToDisk(const FAssetData& Asset
 	if (!PngWrapper.IsValid())
 	{
 		UE_LOG(LogAITagsEditor, Error, TEXT("AITagsEditorSubsystem: Failed to create PNG Wrapper for %s"), *AssetData.AssetName.ToString());
-		return FString();
+		return false;
 	}
 
 	PngWrapper->SetRaw(ImageData.GetData(), ImageData.Num(), Width, Height, ERGBFormat::BGRA, 8);
@@ -252,13 +423,11 @@ FString UAITagsEditorSubsystem::SaveAssetThumbnailToDisk(const FAssetData& Asset
 	{
 		// Rendering failed or empty result
 		UE_LOG(LogAITagsEditor, Error, TEXT("AITagsEditorSubsystem: Failed to compress thumbnail to PNG for %s"), *AssetData.AssetName.ToString());
-		return FString();
+		return false;
 	}
 
 	// 4. Save the raw PNG bytes to disk
-	FFileHelper::SaveArrayToFile(PngBytes, *FullFilePath);
-
-	return FullFilePath;
+	return FFileHelper::SaveArrayToFile(PngBytes, *FullFilePath);
 }
 
 void UAITagsEditorSubsystem::CleanUpTemporaryFolder()
@@ -284,7 +453,7 @@ void UAITagsEditorSubsystem::CleanUpTemporaryFolder()
 	IFileManager::Get().MakeDirectory(*TempDir, /*Tree=*/ true);
 }
 
-void UAITagsEditorSubsystem::WriteAssetImageArrayToJson(const TMap<FAssetData, FString>& AssetImagePaths,
+void UAITagsEditorSubsystem::WriteAssetImageArrayToJson(const TMap<FAssetData, FAITagsAssetThumbnails>& AssetThumbnails,
                                                         const FString& FolderPath, FString& OutFullPath)
 {
 	// 1) Create the root JSON object that holds an array called "Entries"
@@ -293,17 +462,31 @@ void UAITagsEditorSubsystem::WriteAssetImageArrayToJson(const TMap<FAssetData, F
 	// 2) Build a JSON array
 	TArray<TSharedPtr<FJsonValue>> JsonEntries;
 
-	for (const auto& Pair : AssetImagePaths)
+	for (const auto& Pair : AssetThumbnails)
 	{
 		const FAssetData& AssetData = Pair.Key;
-		const FString& ThumbnailPath = Pair.Value;
+		const TArray<FString>& ThumbnailPaths = Pair.Value.ImagePaths;
 
 		// Create one JSON object per entry:
 		TSharedRef<FJsonObject> EntryObj = MakeShared<FJsonObject>();
 		// You can store both the object path and the asset name if you want:
 		EntryObj->SetStringField(TEXT("AssetPath"), AssetData.GetObjectPathString());
 		EntryObj->SetStringField(TEXT("AssetName"), AssetData.AssetName.ToString());
-		EntryObj->SetStringField(TEXT("ImagePath"), ThumbnailPath);
+		// ImagePath is the default view, ImagePaths holds every rendered view for multi-view embedding
+		EntryObj->SetStringField(TEXT("ImagePath"), ThumbnailPaths[0]);
+		TArray<TSharedPtr<FJsonValue>> JsonImagePaths;
+		for (const FString& ThumbnailPath : ThumbnailPaths)
+		{
+			JsonImagePaths.Add(MakeShared<FJsonValueString>(ThumbnailPath));
+		}
+		EntryObj->SetArrayField(TEXT("ImagePaths"), JsonImagePaths);
+		// Editor-side cost of each view, so bench_clip_views.py can include it in the time per asset
+		TArray<TSharedPtr<FJsonValue>> JsonViewRenderMs;
+		for (const double ViewRenderMs : Pair.Value.ViewRenderMs)
+		{
+			JsonViewRenderMs.Add(MakeShared<FJsonValueNumber>(ViewRenderMs));
+		}
+		EntryObj->SetArrayField(TEXT("ViewRenderMs"), JsonViewRenderMs);
 
 		// Wrap EntryObj as a FJsonValueObject and add to the array:
 		JsonEntries.Add(MakeShared<FJsonValueObject>(EntryObj));
@@ -332,11 +515,11 @@ void UAITagsEditorSubsystem::WriteAssetImageArrayToJson(const TMap<FAssetData, F
 	}
 	else
 	{
-		UE_LOG(LogAITagsEditor, Error, TEXT("Failed to serialize AssetImagePaths to JSON"));
+		UE_LOG(LogAITagsEditor, Error, TEXT("Failed to serialize AssetThumbnails to JSON"));
 	}
 }
 
-void UAITagsEditorSubsystem::LaunchCLIP(const FString& InInputFullPath, bool bUsePerCategory, bool bUseThreshold, float Threshold)
+void UAITagsEditorSubsystem::LaunchCLIP(const FString& InInputFullPath, bool bUsePerCategory, bool bUseThreshold, float Threshold, int32 NumViews)
 {
 	const FString PythonExecutablePath = AITagsEditorUtils::GetPythonExecutablePath();
 	const FString CLIPScript = AITagsEditorUtils::GetPythonPluginContentPath() / TEXT("tagging") / TEXT("run_clip_category.py");
@@ -352,12 +535,7 @@ void UAITagsEditorSubsystem::LaunchCLIP(const FString& InInputFullPath, bool bUs
 	bool bLaunchHidden = true;
 	bool bCreatePipes = true; // we want stdout/stderr pipes
 
-	if (CurrentProcess.IsValid())
-	{
-		// @todo: check this code
-		CurrentProcess->Stop();
-		CurrentProcess.Reset();
-	}
+	StopCurrentProcess();
 
 	CurrentProcess = MakeShared<FMonitoredProcess>(
 		PythonExecutablePath,
@@ -382,7 +560,7 @@ void UAITagsEditorSubsystem::LaunchCLIP(const FString& InInputFullPath, bool bUs
 	else
 	{
 		UE_LOG(LogAITagsEditor, Log, TEXT("AITagsEditorSubsystem: Launched CLIP detect for %s"), *InInputFullPath);
-		PushNotification(TEXT("Calculating CLIP tags..."));
+		BeginJob(TEXT("CLIP"), TEXT("Calculating CLIP tags..."), NumViews, bUsePerCategory, bUseThreshold ? Threshold : 0.f);
 	}
 }
 
@@ -401,12 +579,7 @@ void UAITagsEditorSubsystem::LaunchImageToText(const FString& InInputFullPath)
 	bool bLaunchHidden = true;
 	bool bCreatePipes = true; // we want stdout/stderr pipes
 
-	if (CurrentProcess.IsValid())
-	{
-		// @todo: check this code
-		CurrentProcess->Stop();
-		CurrentProcess.Reset();
-	}
+	StopCurrentProcess();
 
 	CurrentProcess = MakeShared<FMonitoredProcess>(
 		PythonExecutablePath,
@@ -426,8 +599,82 @@ void UAITagsEditorSubsystem::LaunchImageToText(const FString& InInputFullPath)
 	else
 	{
 		UE_LOG(LogAITagsEditor, Log, TEXT("AITagsEditorSubsystem: Launched Image2Text for %s"), *InInputFullPath);
-		PushNotification(TEXT("Calculating image2text..."));
+		BeginJob(TEXT("Image2Text"), TEXT("Calculating image2text..."));
+	}
+}
+
+void UAITagsEditorSubsystem::CancelTagging()
+{
+	if (!IsJobRunning())
+	{
+		UE_LOG(LogAITagsEditor, Warning, TEXT("%hs: No tagging job is running."), __FUNCTION__);
+		return;
+	}
+
+	if (JobProgress.bCancelRequested)
+	{
+		return;
+	}
+
+	// The worker polls for this file between items and exits with CancelledReturnCode
+	UE_LOG(LogAITagsEditor, Log, TEXT("%hs: Cancel requested"), __FUNCTION__);
+	const FString CancelFilePath = AITagsEditorUtils::GetCancelFilePath();
+	if (!FFileHelper::SaveStringToFile(TEXT("cancel"), *CancelFilePath))
+	{
+		UE_LOG(LogAITagsEditor, Error, TEXT("AITagsEditorSubsystem: Failed to write cancel file %s"), *CancelFilePath);
+		return;
+	}
+
+	JobProgress.bCancelRequested = true;
+	UpdateNotification();
+}
+
+bool UAITagsEditorSubsystem::IsJobRunning() const
+{
+	return CurrentProcess.IsValid() && CurrentProcess->IsRunning();
+}
+
+void UAITagsEditorSubsystem::StopCurrentProcess()
+{
+	if (!CurrentProcess.IsValid())
+	{
+		return;
+	}
+
+	if (CurrentProcess->IsRunning())
+	{
+		UE_LOG(LogAITagsEditor, Warning, TEXT("%hs: Stopping the running job"), __FUNCTION__);
+		WriteRunLog(AITagsEditorUtils::StoppedReturnCode);
+		PopNotification(AITagsEditorUtils::StoppedReturnCode);
 	}
+	CurrentProcess->Stop();
+	CurrentProcess.Reset();
+}
+
+void UAITagsEditorSubsystem::BeginJob(const FString& InMode, const FString& InMessage, int32 InNumViews, bool bInUsePerCategory, float InThreshold)
+{
+	JobProgress = FAITagsJobProgress();
+	JobProgress.Mode = InMode;
+	JobProgress.NumViews = InNumViews;
+	JobProgress.bUsePerCategory = bInUsePerCategory;
+	JobProgress.Threshold = InThreshold;
+	JobProgress.Stage = TEXT("loading model");
+	JobProgress.ItemsTotal = AssetsForAITagging.Num();
+	JobProgress.StartTime = FPlatformTime::Seconds();
+
+	PushNotification(InMessage);
+	ProgressNotification = FSlateNotificationManager::Get().StartProgressNotification(FText::FromString(InMessage), JobProgress.ItemsTotal);
+	UpdateNotification();
+}
+
+void UAITagsEditorSubsystem::FinishJob(int32 ReturnCode)
+{
+	// Process delegates fire on the monitor thread, notifications and the log belong to the game thread
+	AsyncTask(ENamedThreads::GameThread, [this, ReturnCode]()
+	{
+		WriteRunLog(ReturnCode);
+		PopNotification(ReturnCode);
+	});
 }
 
 void UAITagsEditorSubsystem::PushNotification(const FString& InMessage)
@@ -436,6 +683,11 @@ void UAITagsEditorSubsystem::PushNotification(const FString& InMessage)
 	Info.ExpireDuration = 3.f;
 	Info.bUseSuccessFailIcons = true;
 	Info.bFireAndForget = false;
+	Info.ButtonDetails.Add(FNotificationButtonInfo(
+		LOCTEXT("CancelButton", "Cancel"),
+		LOCTEXT("CancelButtonTooltip", "Stop the job after the current item"),
+		FSimpleDelegate::CreateUObject(this, &UAITagsEditorSubsystem::CancelTagging),
+		SNotificationItem::CS_Pending));
 
 	TSharedPtr<SNotificationItem> Notification = FSlateNotificationManager::Get().AddNotification(Info);
 	if (Notification.IsValid())
@@ -445,31 +697,161 @@ void UAITagsEditorSubsystem::PushNotification(const FString& InMessage)
 	}
 }
 
+void UAITagsEditorSubsystem::UpdateNotification()
+{
+	const double Elapsed = FPlatformTime::Seconds() - JobProgress.StartTime;
+	const int32 ItemsLeft = FMath::Max(JobProgress.ItemsTotal - JobProgress.ItemsDone, 0);
+	const FText EtaText = JobProgress.ItemsPerSecond > 0.f
+		                      ? FText::AsTimespan(FTimespan::FromSeconds(ItemsLeft / JobProgress.ItemsPerSecond))
+		                      : LOCTEXT("UnknownEta", "--");
+
+	FNumberFormattingOptions RateFormat;
+	RateFormat.SetMaximumFractionalDigits(2);
+
+	const FText SubText = FText::Format(
+		LOCTEXT("ProgressSubText", "{0}: {1}/{2}, {3} items/s, ETA {4}, elapsed {5}, errors {6}"),
+		FText::FromString(JobProgress.Stage),
+		FText::AsNumber(JobProgress.ItemsDone),
+		FText::AsNumber(JobProgress.ItemsTotal),
+		FText::AsNumber(JobProgress.ItemsPerSecond, &RateFormat),
+		EtaText,
+		FText::AsTimespan(FTimespan::FromSeconds(Elapsed)),
+		FText::AsNumber(JobProgress.Errors));
+
+	if (LastNotification.IsValid())
+	{
+		// Progress lines keep coming until the worker reaches the next item, don't let them hide the cancel
+		LastNotification.Pin()->SetSubText(JobProgress.bCancelRequested
+			                                   ? LOCTEXT("Cancelling", "Cancelling after the current item...")
+			                                   : SubText);
+	}
+	FSlateNotificationManager::Get().UpdateProgressNotification(ProgressNotification, JobProgress.ItemsDone, JobProgress.ItemsTotal, SubText);
+}
+
 void UAITagsEditorSubsystem::PopNotification(int32 ReturnCode)
 {
+	FSlateNotificationManager::Get().CancelProgressNotification(ProgressNotification);
+	ProgressNotification = FProgressNotificationHandle();
+
 	if (LastNotification.IsValid())
 	{
+		if (ReturnCode == AITagsEditorUtils::CancelledReturnCode)
+		{
+			LastNotification.Pin()->SetSubText(LOCTEXT("Cancelled", "Cancelled"));
+		}
 		LastNotification.Pin()->SetCompletionState(ReturnCode == 0 ? SNotificationItem::CS_Success : SNotificationItem::CS_Fail);
 		LastNotification.Pin()->ExpireAndFadeout();
 		LastNotification.Reset();
 	}
 }
 
+void UAITagsEditorSubsystem::WriteRunLog(int32 ReturnCode) const
+{
+	const FString LogPath = AITagsEditorUtils::GetRunLogPath();
+	const double Seconds = FPlatformTime::Seconds() - JobProgress.StartTime;
+	const TCHAR* Result = TEXT("Failed");
+	if (ReturnCode == 0)
+	{
+		Result = TEXT("Success");
+	}
+	else if (ReturnCode == AITagsEditorUtils::CancelledReturnCode)
+	{
+		Result = TEXT("Cancelled");
+	}
+	else if (ReturnCode == AITagsEditorUtils::StoppedReturnCode)
+	{
+		Result = TEXT("Stopped");
+	}
+
+	FString Line;
+	if (!FPaths::FileExists(LogPath))
+	{
+		Line += TEXT("Timestamp,PluginVersion,EngineVersion,Mode,NumViews,PerCategory,Threshold,Result,ItemsDone,ItemsTotal,Errors,Seconds,ItemsPerSecond,WorkerItemsPerSecond,Device,CPU,GPU\n");
+	}
+	Line += FString::Printf(TEXT("%s,%s,%s,%s,%d,%d,%.2f,%s,%d,%d,%d,%.2f,%.3f,%.3f,%s,%s,%s\n"),
+	                        *FDateTime::UtcNow().ToIso8601(),
+	                        *AITagsEditorUtils::EscapeCsv(AITagsEditorUtils::GetPluginVersion()),
+	                        *AITagsEditorUtils::EscapeCsv(FEngineVersion::Current().ToString()),
+	                        *JobProgress.Mode,
+	                        JobProgress.NumViews,
+	                        JobProgress.bUsePerCategory,
+	                        JobProgress.Threshold,
+	                        Result,
+	                        JobProgress.ItemsDone,
+	                        JobProgress.ItemsTotal,
+	                        JobProgress.Errors,
+	                        Seconds,
+	                        Seconds > 0.0 ? JobProgress.ItemsDone / Seconds : 0.0,
+	                        JobProgress.ItemsPerSecond,
+	                        *AITagsEditorUtils::EscapeCsv(JobProgress.Device),
+	                        *AITagsEditorUtils::EscapeCsv(FPlatformMisc::GetCPUBrand().TrimStartAndEnd()),
+	                        *AITagsEditorUtils::EscapeCsv(FPlatformMisc::GetPrimaryGPUBrand().TrimStartAndEnd()));
+
+	if (!FFileHelper::SaveStringToFile(Line, *LogPath, FFileHelper::EEncodingOptions::ForceUTF8WithoutBOM, &IFileManager::Get(), FILEWRITE_Append))
+	{
+		UE_LOG(LogAITagsEditor, Error, TEXT("AITagsEditorSubsystem: Failed to write run log to %s"), *LogPath);
+	}
+}
+
 void UAITagsEditorSubsystem::HandleCLIPOutputReceived(FString OutputLine)
 {
+	if (OutputLine.StartsWith(AITagsEditorUtils::ProgressPrefix))
+	{
+		HandleProgressReceived(OutputLine.RightChop(FCString::Strlen(AITagsEditorUtils::ProgressPrefix)));
+		return;
+	}
+
 	{
 		UE_LOG(LogAITagsEditor, Display, TEXT("Subprocess: %s"), *OutputLine);
 	}
 }
 
+void UAITagsEditorSubsystem::HandleProgressReceived(const FString& InPayload)
+{
+	TSharedPtr<FJsonObject> ProgressObject;
+	TSharedRef<TJsonReader<>> JsonReader = TJsonReaderFactory<>::Create(InPayload);
+	if (!FJsonSerializer::Deserialize(JsonReader, ProgressObject) || !ProgressObject.IsValid())
+	{
+		UE_LOG(LogAITagsEditor, Warning, TEXT("AITagsEditorSubsystem: Failed to parse progress %s"), *InPayload);
+		return;
+	}
+
+	FAITagsJobProgress Progress;
+	Progress.Stage = ProgressObject->GetStringField(TEXT("stage"));
+	Progress.Device = ProgressObject->GetStringField(TEXT("device"));
+	Progress.ItemsDone = ProgressObject->GetIntegerField(TEXT("done"));
+	Progress.ItemsTotal = ProgressObject->GetIntegerField(TEXT("total"));
+	Progress.Errors = ProgressObject->GetIntegerField(TEXT("errors"));
+	Progress.ItemsPerSecond = ProgressObject->GetNumberField(TEXT("items_per_sec"));
+
+	AsyncTask(ENamedThreads::GameThread, [this, Progress]()
+	{
+		JobProgress.Stage = Progress.Stage;
+		JobProgress.Device = Progress.Device;
+		JobProgress.Errors = Progress.Errors;
+		// Stages without items (loading, saving) keep the counters of the last item stage
+		if (Progress.ItemsTotal > 0)
+		{
+			JobProgress.ItemsDone = Progress.ItemsDone;
+			JobProgress.ItemsTotal = Progress.ItemsTotal;
+			JobProgress.ItemsPerSecond = Progress.ItemsPerSecond;
+		}
+		UpdateNotification();
+	});
+}
+
 void UAITagsEditorSubsystem::HandleCLIPProcessCompleted(int32 ReturnCode)
 {
 	UE_LOG(LogAITagsEditor, Log, TEXT("%hs: Python exited with code %d"), __FUNCTION__, ReturnCode);
 
-	PopNotification(ReturnCode);
+	FinishJob(ReturnCode);
 	
-	// If the child returned nonzero, log and bail
-	if (ReturnCode != 0)
+	// If the child returned nonzero, log and bail. A cancelled worker still saved the entries it finished.
+	if (ReturnCode == AITagsEditorUtils::CancelledReturnCode)
+	{
+		UE_LOG(LogAITagsEditor, Display, TEXT("%hs: cancelled by user, applying finished entries."), __FUNCTION__);
+	}
+	else if (ReturnCode != 0)
 	{
 		UE_LOG(LogAITagsEditor, Error, TEXT("%hs: returned nonzero exit code."), __FUNCTION__);
 		CurrentProcess.Reset();
@@ -509,6 +891,10 @@ void UAITagsEditorSubsystem::HandleCLIPProcessCompleted(int32 ReturnCode)
 			if (!EntryObj.IsValid())
 				continue;
 
+			// Entries the worker failed on have no tags, keep whatever the asset already has
+			if (!EntryObj->HasTypedField<EJson::Array>(TEXT("CLIPTags")))
+				continue;
+
 			const FString AssetPath = EntryObj->GetStringField(TEXT("AssetPath"));
 			TArray<TSharedPtr<FJsonValue>> TagsArray = EntryObj->GetArrayField(TEXT("CLIPTags"));
 			TArray<FString> Tags;
@@ -537,10 +923,14 @@ void UAITagsEditorSubsystem::HandleImageToTextProcessCompleted(int32 ReturnCode)
 {
 	UE_LOG(LogAITagsEditor, Log, TEXT("%hs: Python exited with code %d"), __FUNCTION__, ReturnCode);
 
-	PopNotification(ReturnCode);
+	FinishJob(ReturnCode);
 
-	// If the child returned nonzero, log and bail
-	if (ReturnCode != 0)
+	// If the child returned nonzero, log and bail. A cancelled worker still saved the entries it finished.
+	if (ReturnCode == AITagsEditorUtils::CancelledReturnCode)
+	{
+		UE_LOG(LogAITagsEditor, Display, TEXT("%hs: cancelled by user, applying finished entries."), __FUNCTION__);
+	}
+	else if (ReturnCode != 0)
 	{
 		UE_LOG(LogAITagsEditor, Error, TEXT("%hs: returned nonzero exit code."), __FUNCTION__);
 		CurrentProcess.Reset();
@@ -580,6 +970,9 @@ void UAITagsEditorSubsystem::HandleImageToTextProcessCompleted(int32 ReturnCode)
 			if (!EntryObj.IsValid())
 				continue;
 
+			if (!EntryObj->HasTypedField<EJson::String>(TEXT("Image2Text")))
+				continue;
+
 			const FString AssetPath = EntryObj->GetStringField(TEXT("AssetPath"));
 			FString Image2TextValue = EntryObj->GetStringField(TEXT("Image2Text"));
 			UE_LOG(LogAITagsEditor, Log, TEXT("Entry: %s → %s"), *AssetPath, *Image2TextValue);
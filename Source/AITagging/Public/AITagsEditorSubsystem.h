@@ -6,10 +6,39 @@
 #include "EditorSubsystem.h"
 #include "Misc/MonitoredProcess.h"
 #include "AssetRegistry/AssetData.h"
+#include "Framework/Notifications/NotificationManager.h"
 
 #include "AITagsEditorSubsystem.generated.h"
 
 class SNotificationItem;
+class FObjectThumbnail;
+
+/** Thumbnails rendered for one asset, one entry per view. */
+struct FAITagsAssetThumbnails
+{
+    TArray<FString> ImagePaths;
+    /** Render + PNG compression + disk write time of each view, reported to the benchmark. */
+    TArray<double> ViewRenderMs;
+};
+
+/** Latest numbers reported by the Python worker through its progress channel. */
+struct FAITagsJobProgress
+{
+    FString Mode;
+    FString Stage;
+    FString Device;
+    int32 ItemsDone = 0;
+    int32 ItemsTotal = 0;
+    int32 Errors = 0;
+    float ItemsPerSecond = 0.f;
+    double StartTime = 0.0;
+    bool bCancelRequested = false;
+
+    // Job parameters that drive throughput, logged with every run
+    int32 NumViews = 1;
+    bool bUsePerCategory = false;
+    float Threshold = 0.f;
+};
 
 UCLASS()
 class AITAGGING_API UAITagsEditorSubsystem : public UEditorSubsystem
@@ -26,37 +55,62 @@ public:
     UFUNCTION(CallInEditor, BlueprintCallable, Category = "AITagging")
     void AddAssetsToCache(const TArray<FAssetData>& InAssetDatas);
 
+    /**
+     * Renders NumViews thumbnails per mesh (default camera, back, top, side) and tags each asset
+     * from the average of their CLIP embeddings. NumViews = 1 keeps the single default thumbnail.
+     */
     UFUNCTION(CallInEditor, BlueprintCallable, Category = "AITagging")
-    void StartCLIPTagging(bool bUsePerCategory, bool bUseThreshold, float Threshold);
+    void StartCLIPTagging(bool bUsePerCategory, bool bUseThreshold, float Threshold, int32 NumViews = 1);
 
     UFUNCTION(CallInEditor, BlueprintCallable, Category = "AITagging")
     void StartImageToText();
 
+    /** Asks the running job to stop after the current item, already written output is never cut mid-write. */
+    UFUNCTION(CallInEditor, BlueprintCallable, Category = "AITagging")
+    void CancelTagging();
+
 protected:
     // ~~~ Internal Helpers ~~~
     
-    FString GetHashedFilename(const FAssetData& InAssetData) const;
+    FString GetHashedFilename(const FAssetData& InAssetData, int32 ViewIndex = 0) const;
 
     void CleanUpTemporaryFolder();
-    FString PrepareThumbnailsAndInputFile();
+    FString PrepareThumbnailsAndInputFile(int32 NumViews = 1);
+
+    /** Renders up to NumViews thumbnails of the asset (only meshes get more than one) and returns the saved PNG paths. */
+    FAITagsAssetThumbnails SaveAssetThumbnailsToDisk(const FAssetData& AssetData, const FString& FolderPath, int32 NumViews = 1, int32 ThumbnailSize = 224);
 
-    FString SaveAssetThumbnailToDisk(const FAssetData& AssetData, const FString& FolderPath, int32 ThumbnailSize = 224);
+    bool SaveThumbnailToPng(const FObjectThumbnail& InThumbnail, const FAssetData& AssetData, const FString& FullFilePath);
 
-    void WriteAssetImageArrayToJson(const TMap<FAssetData, FString>& AssetImagePaths, const FString& FolderPath, FString& OutFullPath);
+    void WriteAssetImageArrayToJson(const TMap<FAssetData, FAITagsAssetThumbnails>& AssetThumbnails, const FString& FolderPath, FString& OutFullPath);
 
-    void LaunchCLIP(const FString& InInputFullPath, bool bUsePerCategory, bool bUseThreshold, float Threshold);
+    void LaunchCLIP(const FString& InInputFullPath, bool bUsePerCategory, bool bUseThreshold, float Threshold, int32 NumViews = 1);
     void LaunchImageToText(const FString& InInputFullPath);
 
     /** Delegate: Called each time the subprocess prints a line. We accumulate stdout here. */
     void HandleCLIPOutputReceived(FString OutputLine);
 
+    /** Called from HandleCLIPOutputReceived for every structured progress line of the worker. */
+    void HandleProgressReceived(const FString& InPayload);
+
     /** Delegate: Called once the subprocess has exited. We parse JSON and write metadata to PendingAssetData. */
     void HandleCLIPProcessCompleted(int32 ReturnCode);
     void HandleImageToTextProcessCompleted(int32 ReturnCode);
 
+    bool IsJobRunning() const;
+    /** Kills the current worker. Stop() doesn't fire OnCompleted, so a running job is closed and logged as failed here. */
+    void StopCurrentProcess();
+
+    void BeginJob(const FString& InMode, const FString& InMessage, int32 InNumViews = 1, bool bInUsePerCategory = false, float InThreshold = 0.f);
+    void FinishJob(int32 ReturnCode);
+
     void PushNotification(const FString& InMessage);
+    void UpdateNotification();
     void PopNotification(int32 ReturnCode);
 
+    /** Appends one row per job to Saved/AITagging/RunLog.csv to track throughput across releases and hardware. */
+    void WriteRunLog(int32 ReturnCode) const;
+
 private:
     TArray<FAssetData> AssetsForAITagging;
     
@@ -64,4 +118,7 @@ private:
     TSharedPtr<FMonitoredProcess> CurrentProcess;
     
     TWeakPtr<SNotificationItem> LastNotification;
+    FProgressNotificationHandle ProgressNotification;
+
+    FAITagsJobProgress JobProgress;
 };